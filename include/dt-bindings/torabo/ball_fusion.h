@@ -0,0 +1,8 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+/* Cell of torabo,input-processor-ball-fusion */
+#define BALL_FUSION_PRIMARY 0   /* Chain whose reports carry the merged motion */
+#define BALL_FUSION_SECONDARY 1 /* Chain folded into the primary's next report */
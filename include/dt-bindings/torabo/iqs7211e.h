@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+/* Bit positions in the IQS7211E gestures register (0x0E) */
+#define IQS7211E_GESTURE_SINGLE_TAP 0
+#define IQS7211E_GESTURE_DOUBLE_TAP 1
+#define IQS7211E_GESTURE_TRIPLE_TAP 2
+#define IQS7211E_GESTURE_PRESS_HOLD 3
+#define IQS7211E_GESTURE_PALM 4
+#define IQS7211E_GESTURE_SWIPE_X_POS 8
+#define IQS7211E_GESTURE_SWIPE_X_NEG 9
+#define IQS7211E_GESTURE_SWIPE_Y_POS 10
+#define IQS7211E_GESTURE_SWIPE_Y_NEG 11
+#define IQS7211E_GESTURE_SWIPE_HOLD_X_POS 12
+#define IQS7211E_GESTURE_SWIPE_HOLD_X_NEG 13
+#define IQS7211E_GESTURE_SWIPE_HOLD_Y_POS 14
+#define IQS7211E_GESTURE_SWIPE_HOLD_Y_NEG 15
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+# copyright (C) 2025 sekigon-gonnoc
+"""Decode trackpad diag frames from the CDC-ACM port into a flat record file.
+
+Each output record is RECORD (little-endian, fixed size), so the file can be
+opened with numpy.memmap(path, dtype=RECORD_DTYPE) for analysis.
+
+usage: trackpad_diag.py /dev/ttyACM1 out.bin
+"""
+
+import struct
+import sys
+
+import serial
+
+SYNC = b"\xa5\x5a"
+# seq, dropped, timestamp_ms, info flags, finger 1 x/y/strength/area,
+# finger 2 x/y/strength/area, ALP count, ALP LTA, crc
+FRAME = struct.Struct("<BBI11HB")
+# timestamp_ms, seq, dropped, info flags, finger 1 x/y/strength/area,
+# finger 2 x/y/strength/area, ALP count, ALP LTA, ALP delta
+RECORD = struct.Struct("<IBB11Hh")
+RECORD_DTYPE = [
+    ("timestamp_ms", "<u4"), ("seq", "u1"), ("dropped", "u1"), ("info_flags", "<u2"),
+    ("f1_x", "<u2"), ("f1_y", "<u2"), ("f1_strength", "<u2"), ("f1_area", "<u2"),
+    ("f2_x", "<u2"), ("f2_y", "<u2"), ("f2_strength", "<u2"), ("f2_area", "<u2"),
+    ("alp_count", "<u2"), ("alp_lta", "<u2"), ("alp_delta", "<i2"),
+]
+
+
+def crc8_ccitt(data, crc=0xFF):
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def frames(port):
+    buf = bytearray()
+    frame_len = len(SYNC) + FRAME.size
+    while True:
+        buf += port.read(max(1, port.in_waiting))
+        while len(buf) >= frame_len:
+            start = buf.find(SYNC)
+            if start < 0:
+                del buf[:-1]
+                break
+            if len(buf) - start < frame_len:
+                del buf[:start]
+                break
+            raw = bytes(buf[start:start + frame_len])
+            if crc8_ccitt(raw[:-1]) != raw[-1]:
+                # Not a frame boundary, resync on the next sync pattern
+                del buf[:start + 1]
+                continue
+            del buf[:start + frame_len]
+            yield FRAME.unpack(raw[len(SYNC):])
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    # Opening the port raises DTR, which starts the stream on the device
+    with serial.Serial(sys.argv[1]) as port, open(sys.argv[2], "wb") as out:
+        count = 0
+        try:
+            for seq, dropped, ts, *regs, _crc in frames(port):
+                alp_count, alp_lta = regs[9], regs[10]
+                delta = max(-32768, min(32767, alp_lta - alp_count))
+                out.write(RECORD.pack(ts, seq, dropped, *regs, delta))
+                count += 1
+        except KeyboardInterrupt:
+            pass
+        print(f"{count} records written to {sys.argv[2]}")
+
+
+if __name__ == "__main__":
+    main()
@@ -2,6 +2,16 @@
 // copyright (C) 2025 sekigon-gonnoc
 
 #include <zephyr/sys/util_macro.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/toolchain.h>
+
+#if DT_HAS_COMPAT_STATUS_OKAY(pixart_paw3222)
+// fSCLK limit of the PAW3222 serial port, shared SDIO gives no extra margin
+#define PAW3222_SCLK_MAX_HZ 10000000
+BUILD_ASSERT(DT_PROP(DT_COMPAT_GET_ANY_STATUS_OKAY(pixart_paw3222), spi_max_frequency) <=
+                 PAW3222_SCLK_MAX_HZ,
+             "Trackball spi-max-frequency exceeds the PAW3222 limit");
+#endif
 
 #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
 
@@ -16,6 +26,23 @@
 #include <zmk/events/split_peripheral_status_changed.h>
 #include <zmk/usb.h>
 
+#include "split_power_mgmt.h"
+
+#if IS_ENABLED(CONFIG_TORABO_TRACKBALL_POWER_GATE)
+#include <zephyr/pm/device.h>
+#include <zephyr/sys/atomic.h>
+#include "trackball_cpi.h"
+#define TRACKBALL_NODE DT_NODELABEL(pointing_device)
+#endif
+
+#if DT_HAS_COMPAT_STATUS_OKAY(azoteq_iqs7211e)
+#include <zephyr/drivers/gpio.h>
+#include "iqs7211e_mm.h"
+#include "mini_trackpad_iqs7211e_init.h"
+#include "trackpad_rdy.h"
+#define TRACKPAD_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)
+#endif
+
 LOG_MODULE_REGISTER(split_power_mgmt, CONFIG_ZMK_LOG_LEVEL);
 
 #define SLEEP1_TIMEOUT_MS 5000   // 5 seconds to sleep1 from active
@@ -30,6 +57,7 @@ LOG_MODULE_REGISTER(split_power_mgmt, CONFIG_ZMK_LOG_LEVEL);
 #define SLEEP2_CONN_LATENCY ((CONFIG_ZMK_SPLIT_BLE_PREF_LATENCY+3)/4)  
 #define SLEEP3_CONN_LATENCY ((CONFIG_ZMK_SPLIT_BLE_PREF_LATENCY+7)/8) 
 #define SUPERVISION_TIMEOUT CONFIG_ZMK_SPLIT_BLE_PREF_TIMEOUT
+#define PREWAKE_TIMEOUT_MS 2000  // proximity older than this at the first touch is not a head start
 
 enum power_mode {
     POWER_MODE_ACTIVE,
@@ -43,6 +71,74 @@ static enum power_mode current_mode = POWER_MODE_ACTIVE;
 static int64_t last_activity_time = 0;
 static struct bt_conn *split_conn = NULL;
 
+#if IS_ENABLED(CONFIG_TORABO_TRACKBALL_POWER_GATE)
+static const struct device *trackball = DEVICE_DT_GET(TRACKBALL_NODE);
+// Callers on any thread only set the wanted state, the work item alone runs the
+// PM actions, so a suspend and a resume never overlap
+static struct k_work trackball_power_work;
+static atomic_t trackball_want_down;
+static bool trackball_powered_down = false;
+
+static void trackball_power_work_handler(struct k_work *work) {
+    bool want_down = atomic_get(&trackball_want_down);
+    if (want_down == trackball_powered_down) {
+        return;
+    }
+
+    if (want_down) {
+        int err = pm_device_action_run(trackball, PM_DEVICE_ACTION_SUSPEND);
+        if (err) {
+            LOG_WRN("Failed to power down trackball: %d", err);
+            return;
+        }
+
+        trackball_powered_down = true;
+        LOG_INF("Trackball powered down");
+        return;
+    }
+
+    uint32_t start = k_cycle_get_32();
+    int err = pm_device_action_run(trackball, PM_DEVICE_ACTION_RESUME);
+    if (err) {
+        LOG_WRN("Failed to power up trackball: %d", err);
+        return;
+    }
+
+    // Registers written after the driver's init are gone with the power
+    if (IS_ENABLED(CONFIG_TORABO_TRACKBALL_CPI)) {
+        trackball_cpi_restore();
+    }
+
+    trackball_powered_down = false;
+    uint32_t elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    if (elapsed_us > CONFIG_TORABO_TRACKBALL_RESUME_BUDGET_MS * 1000) {
+        LOG_WRN("Trackball re-init took %u us, over the %d ms budget", elapsed_us,
+                CONFIG_TORABO_TRACKBALL_RESUME_BUDGET_MS);
+    } else {
+        LOG_INF("Trackball re-init took %u us", elapsed_us);
+    }
+}
+#endif
+
+// Only a keypress or trackpad proximity can wake the ball, it cannot see motion while off
+static void trackball_power_down(void) {
+#if IS_ENABLED(CONFIG_TORABO_TRACKBALL_POWER_GATE)
+    if (!atomic_set(&trackball_want_down, true)) {
+        k_work_submit(&trackball_power_work);
+    }
+#endif
+}
+
+static void trackball_power_up(void) {
+#if IS_ENABLED(CONFIG_TORABO_TRACKBALL_POWER_GATE)
+    if (atomic_set(&trackball_want_down, false)) {
+        k_work_submit(&trackball_power_work);
+    }
+#endif
+}
+
+static void trackpad_alp_event(bool enable);
+
 // Power mode transition handler
 static void power_mode_transition(struct k_work *work) {
     if (!split_conn) {
@@ -52,6 +148,7 @@ static void power_mode_transition(struct k_work *work) {
     // Stay in active mode when USB power is connected
     if (zmk_usb_is_powered()) {
         LOG_DBG("USB power detected, staying in active mode");
+        trackball_power_up();
         if (current_mode != POWER_MODE_ACTIVE) {
             // Return to active mode
             struct bt_le_conn_param param = {
@@ -64,6 +161,7 @@ static void power_mode_transition(struct k_work *work) {
             int err = bt_conn_le_param_update(split_conn, &param);
             if (err == 0) {
                 current_mode = POWER_MODE_ACTIVE;
+                trackpad_alp_event(false);
                 LOG_INF("Returned to active mode due to USB power");
             }
         }
@@ -145,7 +243,12 @@ static void power_mode_transition(struct k_work *work) {
     int err = bt_conn_le_param_update(split_conn, &param);
     if (err == 0) {
         current_mode = target_mode;
+        trackpad_alp_event(current_mode != POWER_MODE_ACTIVE);
         LOG_INF("%s mode activated", mode_name);
+
+        if (current_mode == POWER_MODE_SLEEP3) {
+            trackball_power_down();
+        }
         
         // Schedule next transition
         int32_t next_timeout;
@@ -174,6 +277,7 @@ static void power_mode_transition(struct k_work *work) {
 // Reset activity timer on user input
 static void reset_idle_timer(void) {
     LOG_DBG("Activity detected - resetting idle timer");
+    trackball_power_up();
     last_activity_time = k_uptime_get();
     k_work_cancel_delayable(&power_mode_work);
     
@@ -230,6 +334,8 @@ static void power_mgmt_bt_conn_disconnected_cb(struct bt_conn *conn, uint8_t rea
     bt_conn_unref(split_conn);
     split_conn = NULL;
     current_mode = POWER_MODE_ACTIVE;
+    trackpad_alp_event(false);
+    trackball_power_up();
 }
 
 static struct bt_conn_cb power_mgmt_bt_conn_callbacks = {
@@ -237,7 +343,126 @@ static struct bt_conn_cb power_mgmt_bt_conn_callbacks = {
     .disconnected = power_mgmt_bt_conn_disconnected_cb,
 };
 
+#if DT_HAS_COMPAT_STATUS_OKAY(azoteq_iqs7211e)
+// The trackpad asserts RDY on ALP proximity before the finger touches,
+// so use it to bring the split link back to the active interval early
+static const struct gpio_dt_spec trackpad_rdy = GPIO_DT_SPEC_GET(TRACKPAD_NODE, irq_gpios);
+static struct gpio_callback trackpad_rdy_cb;
+static struct k_work prewake_work;
+static int64_t prewake_time = 0;
+
+static void prewake_handler(struct k_work *work) {
+    if (current_mode != POWER_MODE_ACTIVE) {
+        LOG_DBG("Trackpad proximity - waking split link");
+        prewake_time = k_uptime_get();
+        reset_idle_timer();
+    }
+}
+
+static void trackpad_rdy_callback(const struct device *port, struct gpio_callback *cb,
+                                  uint32_t pins) {
+    // Reports in active mode already reset the timer through the input callback
+    if (current_mode != POWER_MODE_ACTIVE) {
+        k_work_submit(&prewake_work);
+    }
+}
+
+// ALP proximity only opens a window while the link sleeps, in active mode every
+// proximity window would be one more RDY and driver read per cycle
+static struct trackpad_rdy_work alp_event_work;
+static atomic_t alp_event_wanted;
+static bool alp_event_enabled = false;
+
+static void alp_event_handler(struct trackpad_rdy_work *rdy_work) {
+    bool enable = atomic_get(&alp_event_wanted);
+    uint8_t buf[] = {CONFIG_SETTINGS0,
+                     CONFIG_SETTINGS1 | (enable ? IQS7211E_CONFIG1_ALP_EVENT : 0)};
+
+    int err = trackpad_rdy_write(rdy_work, IQS7211E_MM_CONFIG_SETTINGS, buf, sizeof(buf));
+    if (err) {
+        if (err != -EAGAIN) {
+            LOG_WRN("Failed to %s trackpad proximity events: %d", enable ? "enable" : "disable",
+                    err);
+        }
+        return;
+    }
+
+    LOG_DBG("Trackpad proximity events %s", enable ? "enabled" : "disabled");
+}
+#endif
+
+static void trackpad_alp_event(bool enable) {
+#if DT_HAS_COMPAT_STATUS_OKAY(azoteq_iqs7211e)
+    if (enable == alp_event_enabled) {
+        return;
+    }
+
+    alp_event_enabled = enable;
+    atomic_set(&alp_event_wanted, enable);
+    if (enable) {
+        // The idle pad opens no window on its own until a touch, write it now
+        trackpad_rdy_work_force(&alp_event_work);
+    } else {
+        trackpad_rdy_work_submit(&alp_event_work);
+    }
+#endif
+}
+
+void split_power_mgmt_input_activity(void) {
+    reset_idle_timer();
+}
+
+#if IS_ENABLED(CONFIG_TORABO_INPUT_PROCESSOR_JITTER)
+// A device is left to the jitter filter only if every chain of every listener on
+// it has a jitter stage, any other chain would let the link sleep while in use
+#define IS_JITTER(node, prop, idx)                                                                 \
+    DT_NODE_HAS_COMPAT(DT_PHANDLE_BY_IDX(node, prop, idx), torabo_input_processor_jitter)
+#define CHAIN_HAS_JITTER(node)                                                                     \
+    COND_CODE_1(DT_NODE_HAS_PROP(node, input_processors),                                          \
+                ((DT_FOREACH_PROP_ELEM_SEP(node, input_processors, IS_JITTER, (||)))), (0))
+#define LAYER_HAS_JITTER(node) &&CHAIN_HAS_JITTER(node)
+#define LISTENER_FILTERED(node) (CHAIN_HAS_JITTER(node) DT_FOREACH_CHILD(node, LAYER_HAS_JITTER))
+#define LISTENS_TO(node, dev) DT_SAME_NODE(DT_PHANDLE(node, device), dev)
+#define ANY_LISTENER(node, dev) || LISTENS_TO(node, dev)
+#define UNFILTERED_LISTENER(node, dev) || (LISTENS_TO(node, dev) && !LISTENER_FILTERED(node))
+#define DEVICE_FILTERED(dev)                                                                       \
+    ((0 DT_FOREACH_STATUS_OKAY_VARGS(zmk_input_listener, ANY_LISTENER, dev)) &&                    \
+     !(0 DT_FOREACH_STATUS_OKAY_VARGS(zmk_input_listener, UNFILTERED_LISTENER, dev)))
+
+// Ball motion resets the timer from the jitter filter once it passes
+static bool is_filtered_ball(const struct device *dev) {
+#if DT_NODE_EXISTS(DT_NODELABEL(pointing_device))
+    if (DEVICE_FILTERED(DT_NODELABEL(pointing_device)) &&
+        dev == DEVICE_DT_GET_OR_NULL(DT_NODELABEL(pointing_device))) {
+        return true;
+    }
+#endif
+#if DT_NODE_EXISTS(DT_NODELABEL(pointing_device_split))
+    if (DEVICE_FILTERED(DT_NODELABEL(pointing_device_split)) &&
+        dev == DEVICE_DT_GET_OR_NULL(DT_NODELABEL(pointing_device_split))) {
+        return true;
+    }
+#endif
+    return false;
+}
+#endif
+
 static void mouse_input_callback(struct input_event *evt) {
+#if DT_HAS_COMPAT_STATUS_OKAY(azoteq_iqs7211e)
+    if (prewake_time != 0 && evt->sync && evt->dev == DEVICE_DT_GET(TRACKPAD_NODE)) {
+        int64_t head_start = k_uptime_get() - prewake_time;
+        // A proximity event with no touch after it is not a head start
+        if (head_start <= PREWAKE_TIMEOUT_MS) {
+            LOG_INF("Proximity wake was %lld ms ahead of touch", head_start);
+        }
+        prewake_time = 0;
+    }
+#endif
+#if IS_ENABLED(CONFIG_TORABO_INPUT_PROCESSOR_JITTER)
+    if (is_filtered_ball(evt->dev)) {
+        return;
+    }
+#endif
     reset_idle_timer();
 }
 
@@ -245,8 +470,20 @@ static int split_power_mgmt_init(void) {
     LOG_INF("Initializing split power management");
     
     k_work_init_delayable(&power_mode_work, power_mode_transition);
+#if IS_ENABLED(CONFIG_TORABO_TRACKBALL_POWER_GATE)
+    k_work_init(&trackball_power_work, trackball_power_work_handler);
+#endif
     
     bt_conn_cb_register(&power_mgmt_bt_conn_callbacks);
+
+#if DT_HAS_COMPAT_STATUS_OKAY(azoteq_iqs7211e)
+    k_work_init(&prewake_work, prewake_handler);
+    trackpad_rdy_work_init(&alp_event_work, alp_event_handler);
+    gpio_init_callback(&trackpad_rdy_cb, trackpad_rdy_callback, BIT(trackpad_rdy.pin));
+    if (gpio_add_callback(trackpad_rdy.port, &trackpad_rdy_cb) != 0) {
+        LOG_WRN("Failed to add trackpad proximity callback");
+    }
+#endif
     
     if (split_conn) {
         last_activity_time = k_uptime_get();
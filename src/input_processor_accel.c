@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_accel
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+
+#define ACCEL_LUT_SIZE 32
+#define ACCEL_LUT_LAST (ACCEL_LUT_SIZE - 1)
+// Speed of the other axis is only carried over between reports this close together
+#define ACCEL_SPEED_HOLD_MS 50
+
+#define ACCEL_CURVE_POWER 0
+#define ACCEL_CURVE_SIGMOID 1
+#define ACCEL_CURVE_CUSTOM 2
+
+// Curve shapes in 1/256 units over the table index, all integer constant expressions
+#define ACCEL_POW(i, e) ((e) == 1 ? (i) : (e) == 2 ? (i) * (i) : (i) * (i) * (i))
+#define ACCEL_F_POWER(n, i)                                                                        \
+    (ACCEL_POW(i, DT_INST_PROP(n, exponent)) * 256 /                                               \
+     ACCEL_POW(ACCEL_LUT_LAST, DT_INST_PROP(n, exponent)))
+
+#define ACCEL_SIG_D(n, i) ((int32_t)(i) - DT_INST_PROP(n, midpoint))
+#define ACCEL_SIG_W2(n) (DT_INST_PROP(n, width) * DT_INST_PROP(n, width))
+#define ACCEL_F_SIGMOID(n, i)                                                                      \
+    (128 + (ACCEL_SIG_D(n, i) < 0 ? -128 : 128) * ACCEL_SIG_D(n, i) * ACCEL_SIG_D(n, i) /          \
+               (ACCEL_SIG_D(n, i) * ACCEL_SIG_D(n, i) + ACCEL_SIG_W2(n)))
+
+#define ACCEL_CUSTOM(n, i)                                                                         \
+    COND_CODE_1(DT_INST_NODE_HAS_PROP(n, points),                                                  \
+                (COND_CODE_1(DT_PROP_HAS_IDX(DT_DRV_INST(n), points, i),                           \
+                             (DT_INST_PROP_BY_IDX(n, points, i)),                                  \
+                             (DT_PROP_LAST(DT_DRV_INST(n), points)))),                             \
+                (256))
+
+#define ACCEL_RANGE(n, f)                                                                          \
+    (DT_INST_PROP(n, min_gain) + (DT_INST_PROP(n, max_gain) - DT_INST_PROP(n, min_gain)) * (f) / 256)
+
+#define ACCEL_GAIN(i, n)                                                                           \
+    (DT_INST_ENUM_IDX(n, curve) == ACCEL_CURVE_CUSTOM ? ACCEL_CUSTOM(n, i)                         \
+     : DT_INST_ENUM_IDX(n, curve) == ACCEL_CURVE_POWER                                             \
+         ? ACCEL_RANGE(n, ACCEL_F_POWER(n, i))                                                     \
+         : ACCEL_RANGE(n, ACCEL_F_SIGMOID(n, i)))
+
+struct accel_config {
+    uint8_t speed_shift;
+    const uint16_t *lut;
+};
+
+struct accel_data {
+    // Carry in 1/256 counts per axis
+    int32_t remainder_x;
+    int32_t remainder_y;
+    // Latest |value| per axis, combined into one table index for both axes
+    uint32_t speed_x;
+    uint32_t speed_y;
+    uint32_t last_time;
+};
+
+static int accel_handle_event(const struct device *dev, struct input_event *event,
+                              uint32_t param1, uint32_t param2,
+                              struct zmk_input_processor_state *state) {
+    const struct accel_config *cfg = dev->config;
+    struct accel_data *data = dev->data;
+    int32_t *remainder;
+    uint32_t *speed;
+    uint32_t other_speed;
+
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    switch (event->code) {
+    case INPUT_REL_X:
+        remainder = &data->remainder_x;
+        speed = &data->speed_x;
+        other_speed = data->speed_y;
+        break;
+    case INPUT_REL_Y:
+        remainder = &data->remainder_y;
+        speed = &data->speed_y;
+        other_speed = data->speed_x;
+        break;
+    default:
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    uint32_t now = k_uptime_get_32();
+    if (now - data->last_time > ACCEL_SPEED_HOLD_MS) {
+        other_speed = 0;
+    }
+    data->last_time = now;
+
+    // Index by max(|dx|, |dy|) so both axes of a diagonal get the same gain
+    *speed = abs(event->value);
+    uint32_t index = MIN(MAX(*speed, other_speed) >> cfg->speed_shift, ACCEL_LUT_LAST);
+    int32_t scaled = event->value * cfg->lut[index] + *remainder;
+    int32_t out = scaled >> 8;
+    *remainder = scaled - (out << 8);
+
+    event->value = out;
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static struct zmk_input_processor_driver_api accel_driver_api = {
+    .handle_event = accel_handle_event,
+};
+
+#define ACCEL_INST(n)                                                                              \
+    BUILD_ASSERT(DT_INST_PROP(n, width) > 0, "width must be positive");                            \
+    static const uint16_t accel_lut_##n[ACCEL_LUT_SIZE] = {                                        \
+        LISTIFY(ACCEL_LUT_SIZE, ACCEL_GAIN, (, ), n)};                                             \
+    static struct accel_data accel_data_##n;                                                       \
+    static const struct accel_config accel_config_##n = {                                          \
+        .speed_shift = DT_INST_PROP(n, speed_shift),                                               \
+        .lut = accel_lut_##n,                                                                      \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, NULL, NULL, &accel_data_##n, &accel_config_##n, POST_KERNEL,          \
+                          CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &accel_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(ACCEL_INST)
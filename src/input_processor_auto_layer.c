@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_auto_layer
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/position_state_changed.h>
+#include <zmk/keymap.h>
+
+LOG_MODULE_REGISTER(input_processor_auto_layer, CONFIG_ZMK_LOG_LEVEL);
+
+struct auto_layer_config {
+    const uint32_t *excluded_positions;
+    size_t excluded_positions_len;
+};
+
+struct auto_layer_data {
+    struct k_work_delayable work;
+    // Only the layer this processor turned on, a user-held layer is left alone
+    bool active;
+    uint8_t layer;
+    uint16_t timeout_ms;
+    uint32_t last_motion;
+};
+
+static void auto_layer_release(struct auto_layer_data *data) {
+    data->active = false;
+    zmk_keymap_layer_deactivate(data->layer);
+    LOG_DBG("Auto layer %d off", data->layer);
+}
+
+static void auto_layer_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct auto_layer_data *data = CONTAINER_OF(dwork, struct auto_layer_data, work);
+
+    if (!data->active) {
+        return;
+    }
+
+    // Motion only stamps the time, the timer catches up here once per timeout
+    uint32_t idle = k_uptime_get_32() - data->last_motion;
+    if (idle < data->timeout_ms) {
+        k_work_schedule(&data->work, K_MSEC(data->timeout_ms - idle));
+        return;
+    }
+
+    auto_layer_release(data);
+}
+
+static int auto_layer_handle_event(const struct device *dev, struct input_event *event,
+                                   uint32_t param1, uint32_t param2,
+                                   struct zmk_input_processor_state *state) {
+    struct auto_layer_data *data = dev->data;
+
+    if (event->type != INPUT_EV_REL ||
+        (event->code != INPUT_REL_X && event->code != INPUT_REL_Y)) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    data->last_motion = k_uptime_get_32();
+    if (data->active || zmk_keymap_layer_active(param1)) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    data->active = true;
+    data->layer = param1;
+    data->timeout_ms = param2;
+    zmk_keymap_layer_activate(param1);
+    k_work_schedule(&data->work, K_MSEC(param2));
+    LOG_DBG("Auto layer %d on", data->layer);
+
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static int auto_layer_init(const struct device *dev) {
+    struct auto_layer_data *data = dev->data;
+
+    k_work_init_delayable(&data->work, auto_layer_work_handler);
+    return 0;
+}
+
+static struct zmk_input_processor_driver_api auto_layer_driver_api = {
+    .handle_event = auto_layer_handle_event,
+};
+
+#define AUTO_LAYER_INST(n)                                                                         \
+    static struct auto_layer_data auto_layer_data_##n;                                             \
+    static const uint32_t auto_layer_excluded_##n[] =                                              \
+        DT_INST_PROP_OR(n, excluded_positions, {});                                                \
+    static const struct auto_layer_config auto_layer_config_##n = {                                \
+        .excluded_positions = auto_layer_excluded_##n,                                             \
+        .excluded_positions_len = DT_INST_PROP_LEN_OR(n, excluded_positions, 0),                   \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, auto_layer_init, NULL, &auto_layer_data_##n, &auto_layer_config_##n,  \
+                          POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,                        \
+                          &auto_layer_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(AUTO_LAYER_INST)
+
+#define AUTO_LAYER_DEV(n) DEVICE_DT_INST_GET(n),
+
+static const struct device *auto_layer_devs[] = {DT_INST_FOREACH_STATUS_OKAY(AUTO_LAYER_DEV)};
+
+static bool is_excluded(const struct auto_layer_config *cfg, uint32_t position) {
+    for (size_t i = 0; i < cfg->excluded_positions_len; i++) {
+        if (cfg->excluded_positions[i] == position) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int auto_layer_listener(const zmk_event_t *eh) {
+    const struct zmk_position_state_changed *pos = as_zmk_position_state_changed(eh);
+    const struct zmk_layer_state_changed *layer = as_zmk_layer_state_changed(eh);
+
+    for (int i = 0; i < ARRAY_SIZE(auto_layer_devs); i++) {
+        const struct auto_layer_config *cfg = auto_layer_devs[i]->config;
+        struct auto_layer_data *data = auto_layer_devs[i]->data;
+
+        if (!data->active) {
+            continue;
+        }
+
+        if (layer) {
+            // Turned off by a keymap binding, the next motion turns it on again
+            if (layer->layer == data->layer && !layer->state) {
+                data->active = false;
+            }
+        } else if (pos->state && !is_excluded(cfg, pos->position)) {
+            // Typing resumed, resolve this key on the layers below
+            auto_layer_release(data);
+        }
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(input_processor_auto_layer, auto_layer_listener);
+ZMK_SUBSCRIPTION(input_processor_auto_layer, zmk_position_state_changed);
+ZMK_SUBSCRIPTION(input_processor_auto_layer, zmk_layer_state_changed);
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_ball_fusion
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+#include <zmk/hid.h>
+#include <dt-bindings/torabo/ball_fusion.h>
+
+struct ball_fusion_config {
+    uint16_t window_ms;
+};
+
+struct ball_fusion_data {
+    const struct device *dev;
+    struct k_work_delayable work;
+    struct k_spinlock lock;
+    // Secondary motion not yet sent, in HID units
+    int32_t x;
+    int32_t y;
+    int32_t wheel;
+    int32_t hwheel;
+    // Last primary report, secondary motion only waits while the primary moves
+    uint32_t primary_time;
+};
+
+// Moves as much of the pending motion into out as one report field holds, the
+// rest waits for the next report
+static void ball_fusion_take(struct ball_fusion_data *data, int32_t *out, int32_t *pending,
+                             int32_t min, int32_t max) {
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    int32_t sum = *out + *pending;
+    *out = CLAMP(sum, min, max);
+    *pending = sum - *out;
+    k_spin_unlock(&data->lock, key);
+}
+
+static bool ball_fusion_pending(struct ball_fusion_data *data) {
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    bool pending = data->x || data->y || data->wheel || data->hwheel;
+    k_spin_unlock(&data->lock, key);
+    return pending;
+}
+
+static void ball_fusion_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct ball_fusion_data *data = CONTAINER_OF(dwork, struct ball_fusion_data, work);
+    const struct ball_fusion_config *cfg = data->dev->config;
+    int32_t x = 0, y = 0, wheel = 0, hwheel = 0;
+
+    ball_fusion_take(data, &x, &data->x, INT16_MIN, INT16_MAX);
+    ball_fusion_take(data, &y, &data->y, INT16_MIN, INT16_MAX);
+    ball_fusion_take(data, &wheel, &data->wheel, INT8_MIN, INT8_MAX);
+    ball_fusion_take(data, &hwheel, &data->hwheel, INT8_MIN, INT8_MAX);
+
+    // The primary ball stayed still for a whole window, send the secondary alone.
+    // The report is built by the listener on this device in the input thread, the
+    // same thread as the other listeners, so they never share a half-built report.
+    if (x || y || wheel || hwheel) {
+        input_report_rel(data->dev, INPUT_REL_X, x, false, K_FOREVER);
+        input_report_rel(data->dev, INPUT_REL_Y, y, false, K_FOREVER);
+        input_report_rel(data->dev, INPUT_REL_WHEEL, wheel, false, K_FOREVER);
+        input_report_rel(data->dev, INPUT_REL_HWHEEL, hwheel, true, K_FOREVER);
+    }
+
+    if (ball_fusion_pending(data)) {
+        k_work_schedule(&data->work, K_MSEC(cfg->window_ms));
+    }
+}
+
+static int32_t *pending_axis(struct ball_fusion_data *data, uint16_t code) {
+    switch (code) {
+    case INPUT_REL_X:
+        return &data->x;
+    case INPUT_REL_Y:
+        return &data->y;
+    case INPUT_REL_WHEEL:
+        return &data->wheel;
+    case INPUT_REL_HWHEEL:
+        return &data->hwheel;
+    default:
+        return NULL;
+    }
+}
+
+static int ball_fusion_secondary(const struct device *dev, struct input_event *event) {
+    const struct ball_fusion_config *cfg = dev->config;
+    struct ball_fusion_data *data = dev->data;
+    int32_t *pending = pending_axis(data, event->code);
+
+    if (!pending) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    *pending += event->value;
+    k_spin_unlock(&data->lock, key);
+
+    // The first motion of a window starts it, later motion rides along. With the
+    // primary at rest there is no report to ride on, so send it now.
+    if (event->sync) {
+        if (k_uptime_get_32() - data->primary_time > cfg->window_ms) {
+            k_work_reschedule(&data->work, K_NO_WAIT);
+        } else {
+            k_work_schedule(&data->work, K_MSEC(cfg->window_ms));
+        }
+    }
+
+    // Nothing reaches this listener, so it never sends a report of its own
+    return ZMK_INPUT_PROC_STOP;
+}
+
+static int ball_fusion_primary(const struct device *dev, struct input_event *event) {
+    struct ball_fusion_data *data = dev->data;
+    int32_t value = event->value;
+
+    // The listener builds the movement from its own events, so add to those
+    if (event->code == INPUT_REL_X) {
+        ball_fusion_take(data, &value, &data->x, INT16_MIN, INT16_MAX);
+    } else if (event->code == INPUT_REL_Y) {
+        ball_fusion_take(data, &value, &data->y, INT16_MIN, INT16_MAX);
+    }
+    event->value = value;
+
+    if (event->sync) {
+        data->primary_time = k_uptime_get_32();
+
+        // The listener keeps the scroll set here when it has no wheel data of its own.
+        // Wheel fields are 8 bits, a larger sum would wrap and scroll the wrong way.
+        int32_t wheel = 0, hwheel = 0;
+        ball_fusion_take(data, &wheel, &data->wheel, INT8_MIN, INT8_MAX);
+        ball_fusion_take(data, &hwheel, &data->hwheel, INT8_MIN, INT8_MAX);
+        if (wheel || hwheel) {
+            zmk_hid_mouse_scroll_set(hwheel, wheel);
+        }
+
+        // Motion that did not fit or an axis the primary did not report this
+        // time still goes out with the window
+        if (!ball_fusion_pending(data)) {
+            k_work_cancel_delayable(&data->work);
+        }
+    }
+
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static int ball_fusion_handle_event(const struct device *dev, struct input_event *event,
+                                    uint32_t param1, uint32_t param2,
+                                    struct zmk_input_processor_state *state) {
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    if (param1 == BALL_FUSION_SECONDARY) {
+        return ball_fusion_secondary(dev, event);
+    }
+
+    return ball_fusion_primary(dev, event);
+}
+
+static int ball_fusion_init(const struct device *dev) {
+    struct ball_fusion_data *data = dev->data;
+
+    data->dev = dev;
+    k_work_init_delayable(&data->work, ball_fusion_work_handler);
+    return 0;
+}
+
+static struct zmk_input_processor_driver_api ball_fusion_driver_api = {
+    .handle_event = ball_fusion_handle_event,
+};
+
+#define BALL_FUSION_INST(n)                                                                        \
+    static struct ball_fusion_data ball_fusion_data_##n;                                           \
+    static const struct ball_fusion_config ball_fusion_config_##n = {                              \
+        .window_ms = DT_INST_PROP(n, window_ms),                                                   \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, ball_fusion_init, NULL, &ball_fusion_data_##n,                        \
+                          &ball_fusion_config_##n, POST_KERNEL,                                    \
+                          CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &ball_fusion_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(BALL_FUSION_INST)
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_inertia
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+
+struct inertia_config {
+    uint16_t tick_ms;
+    uint16_t release_ms;
+    int32_t decay;
+    int32_t start_velocity;
+    int32_t stop_velocity;
+};
+
+struct inertia_axis {
+    // Velocity and carry in 1/256 wheel units
+    int32_t velocity;
+    int32_t remainder;
+};
+
+struct inertia_data {
+    const struct device *dev;
+    struct k_work_delayable work;
+    // Shared by the input thread and the coasting work
+    struct k_spinlock lock;
+    struct inertia_axis wheel;
+    struct inertia_axis hwheel;
+    bool coasting;
+};
+
+static void track_velocity(struct inertia_axis *axis, int32_t value) {
+    // Moving average over about four reports
+    axis->velocity += (value * 256 - axis->velocity) >> 2;
+}
+
+static int8_t coast_step(const struct inertia_config *cfg, struct inertia_axis *axis) {
+    int32_t sum = axis->velocity + axis->remainder;
+    // Wheel fields of the mouse report are 8 bits
+    int32_t out = CLAMP(sum >> 8, INT8_MIN, INT8_MAX);
+    axis->remainder = sum - out * 256;
+    axis->velocity = (axis->velocity * cfg->decay) >> 8;
+    if (abs(axis->velocity) < cfg->stop_velocity) {
+        axis->velocity = 0;
+    }
+    return out;
+}
+
+static void inertia_stop(struct inertia_data *data) {
+    data->coasting = false;
+    data->wheel = (struct inertia_axis){0};
+    data->hwheel = (struct inertia_axis){0};
+}
+
+static void inertia_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct inertia_data *data = CONTAINER_OF(dwork, struct inertia_data, work);
+    const struct inertia_config *cfg = data->dev->config;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    if (!data->coasting) {
+        // Scrolling has paused, coast only if it ended in a flick
+        if (abs(data->wheel.velocity) < cfg->start_velocity &&
+            abs(data->hwheel.velocity) < cfg->start_velocity) {
+            inertia_stop(data);
+            k_spin_unlock(&data->lock, key);
+            return;
+        }
+        data->coasting = true;
+    }
+
+    int8_t wheel = coast_step(cfg, &data->wheel);
+    int8_t hwheel = coast_step(cfg, &data->hwheel);
+    if (data->wheel.velocity == 0 && data->hwheel.velocity == 0) {
+        inertia_stop(data);
+    } else {
+        k_work_schedule(&data->work, K_MSEC(cfg->tick_ms));
+    }
+    k_spin_unlock(&data->lock, key);
+
+    // Coasting leaves as events from this device, so the listener on it builds the
+    // report in the input thread and can pass it through later stages such as fusion
+    if (wheel || hwheel) {
+        input_report_rel(data->dev, INPUT_REL_WHEEL, wheel, false, K_FOREVER);
+        input_report_rel(data->dev, INPUT_REL_HWHEEL, hwheel, true, K_FOREVER);
+    }
+}
+
+static int inertia_handle_event(const struct device *dev, struct input_event *event,
+                                uint32_t param1, uint32_t param2,
+                                struct zmk_input_processor_state *state) {
+    const struct inertia_config *cfg = dev->config;
+    struct inertia_data *data = dev->data;
+
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    // Any new motion is the next touch, which ends coasting
+    if (data->coasting) {
+        k_work_cancel_delayable(&data->work);
+        inertia_stop(data);
+    }
+
+    switch (event->code) {
+    case INPUT_REL_WHEEL:
+        track_velocity(&data->wheel, event->value);
+        break;
+    case INPUT_REL_HWHEEL:
+        track_velocity(&data->hwheel, event->value);
+        break;
+    default:
+        k_spin_unlock(&data->lock, key);
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    k_spin_unlock(&data->lock, key);
+
+    k_work_reschedule(&data->work, K_MSEC(cfg->release_ms));
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static int inertia_init(const struct device *dev) {
+    struct inertia_data *data = dev->data;
+
+    data->dev = dev;
+    k_work_init_delayable(&data->work, inertia_work_handler);
+    return 0;
+}
+
+static struct zmk_input_processor_driver_api inertia_driver_api = {
+    .handle_event = inertia_handle_event,
+};
+
+#define INERTIA_INST(n)                                                                            \
+    static struct inertia_data inertia_data_##n;                                                   \
+    static const struct inertia_config inertia_config_##n = {                                      \
+        .tick_ms = DT_INST_PROP(n, tick_ms),                                                       \
+        .release_ms = DT_INST_PROP(n, release_ms),                                                 \
+        .decay = DT_INST_PROP(n, decay),                                                           \
+        .start_velocity = DT_INST_PROP(n, start_velocity),                                         \
+        .stop_velocity = DT_INST_PROP(n, stop_velocity),                                           \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, inertia_init, NULL, &inertia_data_##n, &inertia_config_##n,           \
+                          POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &inertia_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(INERTIA_INST)
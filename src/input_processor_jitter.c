@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_jitter
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+
+#include "split_power_mgmt.h"
+
+LOG_MODULE_REGISTER(input_processor_jitter, CONFIG_ZMK_LOG_LEVEL);
+
+struct jitter_config {
+    uint16_t threshold;
+    uint16_t window_ms;
+    uint16_t rest_ms;
+};
+
+struct jitter_data {
+    bool moving;
+    uint32_t last_motion;
+    uint32_t window_start;
+    uint32_t energy;
+    // Held back while resting, added back once the motion is real
+    int32_t held_x;
+    int32_t held_y;
+    uint32_t suppressed;
+};
+
+static int jitter_handle_event(const struct device *dev, struct input_event *event,
+                               uint32_t param1, uint32_t param2,
+                               struct zmk_input_processor_state *state) {
+    const struct jitter_config *cfg = dev->config;
+    struct jitter_data *data = dev->data;
+    int32_t *held;
+
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    switch (event->code) {
+    case INPUT_REL_X:
+        held = &data->held_x;
+        break;
+    case INPUT_REL_Y:
+        held = &data->held_y;
+        break;
+    default:
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    uint32_t now = k_uptime_get_32();
+    if (data->moving && now - data->last_motion >= cfg->rest_ms) {
+        data->moving = false;
+        data->energy = 0;
+    }
+
+    if (!data->moving) {
+        if (data->energy == 0 || now - data->window_start >= cfg->window_ms) {
+            data->window_start = now;
+            data->energy = 0;
+            data->held_x = 0;
+            data->held_y = 0;
+        }
+
+        data->energy += abs(event->value);
+        if (data->energy < cfg->threshold) {
+            *held += event->value;
+            data->suppressed++;
+            return ZMK_INPUT_PROC_STOP;
+        }
+
+        LOG_DBG("Ball moving, %u jitter events suppressed while resting", data->suppressed);
+        data->moving = true;
+        data->suppressed = 0;
+    }
+
+    event->value += *held;
+    *held = 0;
+    data->last_motion = now;
+    if (IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)) {
+        split_power_mgmt_input_activity();
+    }
+
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static struct zmk_input_processor_driver_api jitter_driver_api = {
+    .handle_event = jitter_handle_event,
+};
+
+#define JITTER_INST(n)                                                                             \
+    static struct jitter_data jitter_data_##n;                                                     \
+    static const struct jitter_config jitter_config_##n = {                                        \
+        .threshold = DT_INST_PROP(n, threshold),                                                   \
+        .window_ms = DT_INST_PROP(n, window_ms),                                                   \
+        .rest_ms = DT_INST_PROP(n, rest_ms),                                                       \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, NULL, NULL, &jitter_data_##n, &jitter_config_##n, POST_KERNEL,        \
+                          CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &jitter_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(JITTER_INST)
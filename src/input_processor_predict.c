@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_predict
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <drivers/input_processor.h>
+
+// Samples further apart than this start a new stroke
+#define PREDICT_MAX_GAP_MS 50
+
+struct predict_config {
+    uint16_t lead_ms;
+    uint16_t max_lead;
+    uint16_t release_ms;
+};
+
+struct predict_axis {
+    // Velocity in 1/256 counts per ms
+    int32_t velocity;
+    // Counts sent ahead of the ball and not yet taken back
+    int32_t lead;
+    uint32_t last_time;
+};
+
+struct predict_data {
+    const struct device *dev;
+    struct k_work_delayable work;
+    struct k_spinlock lock;
+    struct predict_axis x;
+    struct predict_axis y;
+};
+
+static int32_t predict_step(const struct predict_config *cfg, struct predict_axis *axis,
+                            int32_t value, uint32_t now) {
+    uint32_t dt = now - axis->last_time;
+    axis->last_time = now;
+
+    if (dt > PREDICT_MAX_GAP_MS) {
+        axis->velocity = 0;
+    } else {
+        // Average over the last few deltas
+        int32_t sample = value * 256 / (int32_t)MAX(dt, 1);
+        axis->velocity += (sample - axis->velocity) >> 1;
+    }
+
+    // Never lead by more than the ball moved, which bounds the overshoot on a stop
+    int32_t limit = MIN(abs(value), cfg->max_lead);
+    int32_t lead = CLAMP((axis->velocity * cfg->lead_ms) >> 8, -limit, limit);
+
+    // Sending only the change in lead corrects the previous guess in this report
+    int32_t out = value + lead - axis->lead;
+    axis->lead = lead;
+    return out;
+}
+
+static void predict_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct predict_data *data = CONTAINER_OF(dwork, struct predict_data, work);
+
+    // The ball stopped, take the lead back so the cursor rests where the ball did
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    int16_t x = -data->x.lead;
+    int16_t y = -data->y.lead;
+    data->x = (struct predict_axis){0};
+    data->y = (struct predict_axis){0};
+    k_spin_unlock(&data->lock, key);
+
+    // Reported from this device, so the listener on it sends the take-back from the
+    // input thread instead of racing the other listeners for the mouse report
+    if (x || y) {
+        input_report_rel(data->dev, INPUT_REL_X, x, false, K_FOREVER);
+        input_report_rel(data->dev, INPUT_REL_Y, y, true, K_FOREVER);
+    }
+}
+
+static int predict_handle_event(const struct device *dev, struct input_event *event,
+                                uint32_t param1, uint32_t param2,
+                                struct zmk_input_processor_state *state) {
+    const struct predict_config *cfg = dev->config;
+    struct predict_data *data = dev->data;
+    struct predict_axis *axis;
+
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    switch (event->code) {
+    case INPUT_REL_X:
+        axis = &data->x;
+        break;
+    case INPUT_REL_Y:
+        axis = &data->y;
+        break;
+    default:
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    int32_t out = predict_step(cfg, axis, event->value, k_uptime_get_32());
+    k_spin_unlock(&data->lock, key);
+
+    event->value = CLAMP(out, INT16_MIN, INT16_MAX);
+    k_work_reschedule(&data->work, K_MSEC(cfg->release_ms));
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+static int predict_init(const struct device *dev) {
+    struct predict_data *data = dev->data;
+
+    data->dev = dev;
+    k_work_init_delayable(&data->work, predict_work_handler);
+    return 0;
+}
+
+static struct zmk_input_processor_driver_api predict_driver_api = {
+    .handle_event = predict_handle_event,
+};
+
+#define PREDICT_INST(n)                                                                            \
+    static struct predict_data predict_data_##n;                                                   \
+    static const struct predict_config predict_config_##n = {                                      \
+        .lead_ms = DT_INST_PROP(n, lead_ms),                                                       \
+        .max_lead = DT_INST_PROP(n, max_lead),                                                     \
+        .release_ms = DT_INST_PROP(n, release_ms),                                                 \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, predict_init, NULL, &predict_data_##n, &predict_config_##n,           \
+                          POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &predict_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PREDICT_INST)
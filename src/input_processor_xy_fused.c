@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_input_processor_xy_fused
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <dt-bindings/zmk/input_transform.h>
+#include <drivers/input_processor.h>
+
+// Cross terms older than this belong to a finished stroke and are dropped
+#define XY_FUSED_MAX_GAP_MS 50
+
+// sin(0..90 degrees) in Q15
+static const int16_t sin_q15_table[91] = {
+    0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+    5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767,
+};
+
+struct xy_fused_data {
+    // Rotation cross terms waiting for the other axis, and Q15 carries
+    int32_t pending_x;
+    int32_t pending_y;
+    int32_t remainder_x;
+    int32_t remainder_y;
+    uint32_t last_time;
+};
+
+static ALWAYS_INLINE int32_t sin_q15(int32_t deg) {
+    if (deg <= 90) {
+        return sin_q15_table[deg];
+    } else if (deg <= 180) {
+        return sin_q15_table[180 - deg];
+    } else if (deg <= 270) {
+        return -sin_q15_table[deg - 180];
+    }
+    return -sin_q15_table[360 - deg];
+}
+
+static ALWAYS_INLINE int32_t rotate_q15(int32_t acc, int32_t *remainder) {
+    acc += *remainder;
+    int32_t out = acc >> 15;
+    *remainder = acc - (out << 15);
+    return out;
+}
+
+// Inlined into each instance's handler so unused steps fold away
+static ALWAYS_INLINE int xy_fused_apply(struct input_event *event,
+                                        struct zmk_input_processor_state *state,
+                                        struct xy_fused_data *data, uint32_t flags, int32_t deg,
+                                        int32_t mul, int32_t div, int32_t clamp) {
+    if (event->type != INPUT_EV_REL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    bool is_x;
+    switch (event->code) {
+    case INPUT_REL_X:
+        is_x = true;
+        break;
+    case INPUT_REL_Y:
+        is_x = false;
+        break;
+    default:
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    if (flags & INPUT_TRANSFORM_XY_SWAP) {
+        is_x = !is_x;
+        event->code = is_x ? INPUT_REL_X : INPUT_REL_Y;
+    }
+
+    int32_t value = event->value;
+    if (is_x ? (flags & INPUT_TRANSFORM_X_INVERT) : (flags & INPUT_TRANSFORM_Y_INVERT)) {
+        value = -value;
+    }
+
+    // Rotation needs both axes, but they arrive as separate events. The Y
+    // term of X is taken from the previous report's Y, which is one report
+    // late but keeps the total motion exact.
+    if (deg != 0) {
+        int32_t c = sin_q15((deg + 90) % 360);
+        int32_t s = sin_q15(deg);
+
+        uint32_t now = k_uptime_get_32();
+        if (now - data->last_time > XY_FUSED_MAX_GAP_MS) {
+            data->pending_x = 0;
+            data->pending_y = 0;
+        }
+        data->last_time = now;
+
+        if (is_x) {
+            int32_t acc = c * value + data->pending_x;
+            data->pending_x = 0;
+            data->pending_y += s * value;
+            value = rotate_q15(acc, &data->remainder_x);
+        } else {
+            int32_t acc = c * value + data->pending_y;
+            data->pending_y = 0;
+            data->pending_x -= s * value;
+            value = rotate_q15(acc, &data->remainder_y);
+        }
+    }
+
+    if (mul != div) {
+        value *= mul;
+        if (state && state->remainder) {
+            value += *state->remainder;
+        }
+        int32_t scaled = value / div;
+        if (state && state->remainder) {
+            *state->remainder = value - scaled * div;
+        }
+        value = scaled;
+    }
+
+    if (clamp) {
+        value = CLAMP(value, -clamp, clamp);
+    }
+
+    event->value = value;
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+#define XY_FUSED_INST(n)                                                                           \
+    BUILD_ASSERT(DT_INST_PROP(n, scale_divisor) > 0, "scale-divisor must be positive");            \
+    static struct xy_fused_data xy_fused_data_##n;                                                 \
+    static int xy_fused_handle_event_##n(const struct device *dev, struct input_event *event,       \
+                                         uint32_t param1, uint32_t param2,                         \
+                                         struct zmk_input_processor_state *state) {                \
+        return xy_fused_apply(event, state, &xy_fused_data_##n, DT_INST_PROP(n, transform),        \
+                              ((DT_INST_PROP(n, rotation) % 360) + 360) % 360,                     \
+                              DT_INST_PROP(n, scale_multiplier), DT_INST_PROP(n, scale_divisor),   \
+                              DT_INST_PROP(n, clamp));                                             \
+    }                                                                                              \
+    static struct zmk_input_processor_driver_api xy_fused_driver_api_##n = {                       \
+        .handle_event = xy_fused_handle_event_##n,                                                 \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, NULL, NULL, &xy_fused_data_##n, NULL, POST_KERNEL,                    \
+                          CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &xy_fused_driver_api_##n);
+
+DT_INST_FOREACH_STATUS_OKAY(XY_FUSED_INST)
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+/* IQS7211E memory map addresses used by the register images and board code */
+#define IQS7211E_MM_GESTURES 0x0E
+#define IQS7211E_MM_INFO_FLAGS 0x0F
+#define IQS7211E_MM_FINGER_1_X 0x10
+#define IQS7211E_MM_ALP_COUNT 0x18
+#define IQS7211E_MM_ALP_LTA 0x19
+#define IQS7211E_MM_ALP_ATI_COMP_A 0x1F
+#define IQS7211E_MM_TP_GLOBAL_MIRRORS 0x21
+#define IQS7211E_MM_ACTIVE_MODE_RR 0x28
+#define IQS7211E_MM_SYS_CONTROL 0x33
+#define IQS7211E_MM_CONFIG_SETTINGS 0x34
+#define IQS7211E_MM_ALP_SETUP 0x36
+#define IQS7211E_MM_TP_TOUCH_SET_CLEAR_THR 0x38
+#define IQS7211E_MM_LP1_FILTERS 0x3B
+#define IQS7211E_MM_TP_CONV_FREQ 0x3D
+#define IQS7211E_MM_TP_RX_SETTINGS 0x41
+#define IQS7211E_MM_SETTINGS_VERSION 0x4A
+#define IQS7211E_MM_GESTURE_ENABLE 0x4B
+#define IQS7211E_MM_RX_TX_MAPPING_0_1 0x56
+#define IQS7211E_MM_PROXA_CYCLE0 0x5D
+#define IQS7211E_MM_PROXA_CYCLE10 0x6C
+#define IQS7211E_MM_PROXA_CYCLE20 0x7B
+
+/* CONFIG_SETTINGS1 bits */
+#define IQS7211E_CONFIG1_EVENT_MODE (1 << 0)
+#define IQS7211E_CONFIG1_GESTURE_EVENT (1 << 1)
+#define IQS7211E_CONFIG1_TP_EVENT (1 << 2)
+#define IQS7211E_CONFIG1_ALP_EVENT (1 << 4)
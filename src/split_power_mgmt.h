@@ -0,0 +1,8 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+// Count as user activity for the split link power tiers, for input that only
+// becomes real activity after a processor has looked at it
+void split_power_mgmt_input_activity(void);
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_trackball_cpi
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/keymap.h>
+#include <paw3222.h>
+
+#include "trackball_cpi.h"
+
+LOG_MODULE_REGISTER(trackball_cpi, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKBALL_NODE DT_NODELABEL(pointing_device)
+#define CPI_NODE DT_DRV_INST(0)
+
+BUILD_ASSERT(DT_NODE_HAS_COMPAT(TRACKBALL_NODE, pixart_paw3222),
+             "Per-layer CPI needs the PAW3222 trackball");
+
+// The sensor sets its resolution in 38 CPI steps
+#define PAW3222_CPI_STEP 38
+#define PAW3222_CPI_MIN (16 * PAW3222_CPI_STEP)
+#define PAW3222_CPI_MAX (127 * PAW3222_CPI_STEP)
+
+struct layer_cpi {
+    uint32_t layers;
+    uint16_t cpi;
+};
+
+#define LAYER_BIT(node, prop, idx) BIT(DT_PROP_BY_IDX(node, prop, idx))
+#define LAYER_CPI_ENTRY(node)                                                                      \
+    {                                                                                              \
+        .layers = DT_FOREACH_PROP_ELEM_SEP(node, layers, LAYER_BIT, (|)),                          \
+        .cpi = DT_PROP(node, cpi),                                                                 \
+    },
+
+static const struct layer_cpi layer_cpis[] = {DT_FOREACH_CHILD(CPI_NODE, LAYER_CPI_ENTRY)};
+
+#define CPI_IN_RANGE(node) BUILD_ASSERT(IN_RANGE(DT_PROP(node, cpi), PAW3222_CPI_MIN, PAW3222_CPI_MAX));
+DT_FOREACH_CHILD(CPI_NODE, CPI_IN_RANGE)
+CPI_IN_RANGE(CPI_NODE)
+
+static const struct device *trackball = DEVICE_DT_GET(TRACKBALL_NODE);
+// The driver reads motion on the system workqueue too, so a change never lands in
+// the middle of its SPI transfer
+static struct k_work cpi_work;
+static atomic_t cpi_lost;
+// The driver starts at the res-cpi of the devicetree node
+static uint16_t current_cpi = DT_PROP(TRACKBALL_NODE, res_cpi);
+
+static uint16_t target_cpi(void) {
+    for (int i = 0; i < ARRAY_SIZE(layer_cpis); i++) {
+        if (zmk_keymap_layer_state() & layer_cpis[i].layers) {
+            return layer_cpis[i].cpi;
+        }
+    }
+
+    return DT_PROP(CPI_NODE, cpi);
+}
+
+static void cpi_work_handler(struct k_work *work) {
+    uint16_t cpi = target_cpi();
+    if (atomic_clear(&cpi_lost)) {
+        current_cpi = 0;
+    }
+    if (cpi == current_cpi) {
+        return;
+    }
+
+    int err = paw3222_set_resolution(trackball, cpi);
+    if (err) {
+        LOG_WRN("Failed to set trackball CPI: %d", err);
+        return;
+    }
+
+    current_cpi = cpi;
+    LOG_DBG("Trackball CPI set to %d", cpi);
+}
+
+void trackball_cpi_restore(void) {
+    atomic_set(&cpi_lost, true);
+    k_work_submit(&cpi_work);
+}
+
+static int layer_state_changed_listener(const zmk_event_t *eh) {
+    k_work_submit(&cpi_work);
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(trackball_cpi, layer_state_changed_listener);
+ZMK_SUBSCRIPTION(trackball_cpi, zmk_layer_state_changed);
+
+static int trackball_cpi_init(void) {
+    k_work_init(&cpi_work, cpi_work_handler);
+    // Runs after the driver has configured the sensor
+    k_work_submit(&cpi_work);
+    return 0;
+}
+
+SYS_INIT(trackball_cpi_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
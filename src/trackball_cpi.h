@@ -0,0 +1,7 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+// Set the CPI for the active layers again, after the sensor lost its registers
+void trackball_cpi_restore(void);
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_REGISTER(trackball_stats, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKBALL_NODE DT_NODELABEL(pointing_device)
+#define STATS_PERIOD_MS 1000
+
+BUILD_ASSERT(DT_NODE_HAS_COMPAT(TRACKBALL_NODE, pixart_paw3222),
+             "Trackball counters need the PAW3222 trackball");
+
+static const struct gpio_dt_spec motion_gpio = GPIO_DT_SPEC_GET(TRACKBALL_NODE, irq_gpios);
+static struct gpio_callback motion_cb;
+static struct k_work start_work;
+static struct k_work_delayable stats_work;
+static atomic_t irq_count;
+static atomic_t report_count;
+// Motion edge to finished report: driver scheduling delay plus its SPI read
+static atomic_t irq_stamp;
+static atomic_t latency_count;
+static atomic_t latency_cycles;
+static atomic_t latency_max_cycles;
+static k_thread_runtime_stats_t last_cpu;
+
+static void stats_log(struct k_work *work) {
+    atomic_val_t irqs = atomic_clear(&irq_count);
+    atomic_val_t reports = atomic_clear(&report_count);
+    atomic_val_t latencies = atomic_clear(&latency_count);
+    uint32_t latency_us = k_cyc_to_us_floor32(atomic_clear(&latency_cycles)) / MAX(latencies, 1);
+    uint32_t latency_max_us = k_cyc_to_us_floor32(atomic_clear(&latency_max_cycles));
+    k_thread_runtime_stats_t cpu;
+
+    // Busy cycles of every thread and ISR against all cycles in the period
+    k_thread_runtime_stats_all_get(&cpu);
+    uint64_t busy = cpu.total_cycles - last_cpu.total_cycles;
+    uint64_t elapsed = cpu.execution_cycles - last_cpu.execution_cycles;
+    last_cpu = cpu;
+
+    // Stay quiet and stop polling while the ball is still
+    if (irqs == 0 && reports == 0) {
+        return;
+    }
+
+    LOG_INF("Trackball %ld IRQ/s, %ld reports/s, CPU %d.%d%%", irqs * 1000 / STATS_PERIOD_MS,
+            reports * 1000 / STATS_PERIOD_MS, (int)(busy * 100 / MAX(elapsed, 1)),
+            (int)(busy * 1000 / MAX(elapsed, 1) % 10));
+    LOG_INF("Trackball IRQ to report %u us avg, %u us max", latency_us, latency_max_us);
+    k_work_schedule(&stats_work, K_MSEC(STATS_PERIOD_MS));
+}
+
+static void stats_start(struct k_work *work) {
+    // A period starts with the first motion after the ball was still, so the
+    // CPU load is not averaged over the idle gap before it
+    k_thread_runtime_stats_all_get(&last_cpu);
+    k_work_reschedule(&stats_work, K_MSEC(STATS_PERIOD_MS));
+}
+
+static void motion_callback(const struct device *port, struct gpio_callback *cb, uint32_t pins) {
+    atomic_inc(&irq_count);
+    // Keep the first edge, the driver reads once for a burst of them
+    atomic_cas(&irq_stamp, 0, k_cycle_get_32() | 1);
+    if (!k_work_delayable_is_pending(&stats_work)) {
+        k_work_submit(&start_work);
+    }
+}
+
+static void trackball_input_callback(struct input_event *evt) {
+    if (!evt->sync) {
+        return;
+    }
+
+    atomic_inc(&report_count);
+
+    atomic_val_t stamp = atomic_clear(&irq_stamp);
+    if (stamp != 0) {
+        uint32_t cycles = (k_cycle_get_32() | 1) - (uint32_t)stamp;
+        atomic_inc(&latency_count);
+        atomic_add(&latency_cycles, cycles);
+        if (cycles > (uint32_t)atomic_get(&latency_max_cycles)) {
+            atomic_set(&latency_max_cycles, cycles);
+        }
+    }
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(TRACKBALL_NODE), trackball_input_callback);
+
+static int trackball_stats_init(void) {
+    k_work_init(&start_work, stats_start);
+    k_work_init_delayable(&stats_work, stats_log);
+
+    // The driver owns the motion interrupt configuration, only listen alongside it
+    gpio_init_callback(&motion_cb, motion_callback, BIT(motion_gpio.pin));
+    int err = gpio_add_callback(motion_gpio.port, &motion_cb);
+    if (err) {
+        LOG_ERR("Failed to add motion callback: %d", err);
+        return err;
+    }
+
+    return 0;
+}
+
+SYS_INIT(trackball_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include "iqs7211e_mm.h"
+#include "trackpad_rdy.h"
+
+LOG_MODULE_REGISTER(trackpad_diag, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKPAD_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)
+#define DIAG_UART_NODE DT_CHOSEN(torabo_trackpad_diag_uart)
+
+#define DIAG_SYNC0 0xA5
+#define DIAG_SYNC1 0x5A
+// Info flags through ALP LTA, one 16-bit word per register
+#define DIAG_FIRST_REG IQS7211E_MM_INFO_FLAGS
+#define DIAG_REG_COUNT (IQS7211E_MM_ALP_LTA - IQS7211E_MM_INFO_FLAGS + 1)
+
+// Frame layout is decoded by scripts/trackpad_diag.py
+struct diag_frame {
+    uint8_t sync[2];
+    uint8_t seq;
+    uint8_t dropped;
+    uint32_t timestamp_ms;
+    uint8_t regs[DIAG_REG_COUNT * 2];
+    uint8_t crc;
+} __packed;
+
+static const struct device *diag_uart = DEVICE_DT_GET(DIAG_UART_NODE);
+
+RING_BUF_DECLARE(diag_ring, CONFIG_TORABO_TRACKPAD_DIAG_BUF_SIZE);
+static struct diag_frame frame = {.sync = {DIAG_SYNC0, DIAG_SYNC1}};
+static struct trackpad_rdy_work diag_work;
+static uint8_t dropped_frames;
+
+static bool host_listening(void) {
+    uint32_t dtr = 0;
+    return uart_line_ctrl_get(diag_uart, UART_LINE_CTRL_DTR, &dtr) == 0 && dtr;
+}
+
+static void diag_uart_callback(const struct device *dev, void *user_data) {
+    while (uart_irq_update(dev) && uart_irq_is_pending(dev)) {
+        if (!uart_irq_tx_ready(dev)) {
+            continue;
+        }
+
+        uint8_t *data;
+        uint32_t len = ring_buf_get_claim(&diag_ring, &data, CONFIG_TORABO_TRACKPAD_DIAG_BUF_SIZE);
+        if (len == 0) {
+            uart_irq_tx_disable(dev);
+            continue;
+        }
+
+        int sent = uart_fifo_fill(dev, data, len);
+        ring_buf_get_finish(&diag_ring, MAX(sent, 0));
+    }
+}
+
+static void diag_work_handler(struct trackpad_rdy_work *rdy_work) {
+    // Nobody is reading, so skip the I2C traffic and let stale data go until
+    // the next report starts the frames again
+    if (!host_listening()) {
+        uart_irq_tx_disable(diag_uart);
+        ring_buf_reset(&diag_ring);
+        return;
+    }
+
+    // One frame per window, also for windows the driver has no report for
+    int err = trackpad_rdy_read(rdy_work, DIAG_FIRST_REG, frame.regs, sizeof(frame.regs));
+    if (err == -EAGAIN) {
+        return;
+    }
+    trackpad_rdy_work_submit_next(rdy_work);
+    if (err) {
+        LOG_WRN("Failed to read trackpad counts: %d", err);
+        return;
+    }
+
+    frame.seq++;
+    frame.dropped = dropped_frames;
+    sys_put_le32(k_uptime_get_32(), (uint8_t *)&frame.timestamp_ms);
+    frame.crc = crc8_ccitt(0xFF, &frame, offsetof(struct diag_frame, crc));
+
+    if (ring_buf_space_get(&diag_ring) < sizeof(frame)) {
+        dropped_frames++;
+    } else {
+        ring_buf_put(&diag_ring, (uint8_t *)&frame, sizeof(frame));
+        dropped_frames = 0;
+    }
+
+    uart_irq_tx_enable(diag_uart);
+}
+
+static void trackpad_input_callback(struct input_event *evt) {
+    if (evt->sync) {
+        trackpad_rdy_work_submit(&diag_work);
+    }
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(TRACKPAD_NODE), trackpad_input_callback);
+
+static int trackpad_diag_init(void) {
+    if (!device_is_ready(diag_uart)) {
+        LOG_ERR("Trackpad diag UART not ready");
+        return -ENODEV;
+    }
+
+    trackpad_rdy_work_init(&diag_work, diag_work_handler);
+    uart_irq_callback_set(diag_uart, diag_uart_callback);
+
+    return 0;
+}
+
+SYS_INIT(trackpad_diag_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
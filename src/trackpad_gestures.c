@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#define DT_DRV_COMPAT torabo_trackpad_gestures
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zmk/behavior.h>
+#include <zmk/keymap.h>
+#include <dt-bindings/torabo/iqs7211e.h>
+
+#include "iqs7211e_mm.h"
+#include "trackpad_rdy.h"
+
+LOG_MODULE_REGISTER(trackpad_gestures, CONFIG_ZMK_LOG_LEVEL);
+
+#define GESTURES_NODE DT_DRV_INST(0)
+#define TRACKPAD_NODE DT_PHANDLE(GESTURES_NODE, device)
+
+BUILD_ASSERT(DT_SAME_NODE(TRACKPAD_NODE, DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)),
+             "Gestures are read from the IQS7211E that owns the RDY window");
+
+// Taps and swipes are reported for one cycle, hold gestures stay set while held
+#define HOLD_GESTURES                                                                              \
+    (BIT(IQS7211E_GESTURE_PRESS_HOLD) | BIT(IQS7211E_GESTURE_SWIPE_HOLD_X_POS) |                  \
+     BIT(IQS7211E_GESTURE_SWIPE_HOLD_X_NEG) | BIT(IQS7211E_GESTURE_SWIPE_HOLD_Y_POS) |            \
+     BIT(IQS7211E_GESTURE_SWIPE_HOLD_Y_NEG))
+
+struct gesture_map {
+    uint8_t gesture;
+    struct zmk_behavior_binding binding;
+};
+
+#define GESTURE_MAP_ENTRY(node)                                                                    \
+    {                                                                                              \
+        .gesture = DT_PROP(node, gesture),                                                         \
+        .binding =                                                                                 \
+            {                                                                                      \
+                .behavior_dev = DEVICE_DT_NAME(DT_PHANDLE_BY_IDX(node, bindings, 0)),              \
+                .param1 = COND_CODE_0(DT_PHA_HAS_CELL_AT_IDX(node, bindings, 0, param1), (0),      \
+                                      (DT_PHA_BY_IDX(node, bindings, 0, param1))),                 \
+                .param2 = COND_CODE_0(DT_PHA_HAS_CELL_AT_IDX(node, bindings, 0, param2), (0),      \
+                                      (DT_PHA_BY_IDX(node, bindings, 0, param2))),                 \
+            },                                                                                     \
+    },
+
+static const struct gesture_map gesture_maps[] = {
+    DT_FOREACH_CHILD(GESTURES_NODE, GESTURE_MAP_ENTRY)};
+
+// Behaviors are invoked on the system workqueue, not in the RDY window
+K_MSGQ_DEFINE(gesture_msgq, sizeof(uint16_t), 4, 2);
+static struct trackpad_rdy_work gesture_work;
+static struct k_work invoke_work;
+static uint16_t mapped_gestures;
+static uint16_t read_gestures;
+static uint16_t held_gestures;
+
+static void invoke_gesture(const struct gesture_map *map, bool pressed) {
+    struct zmk_behavior_binding_event event = {
+        .layer = zmk_keymap_highest_layer_active(),
+        .position = INT32_MAX,
+        .timestamp = k_uptime_get(),
+    };
+
+    int ret = zmk_behavior_invoke_binding(&map->binding, event, pressed);
+    if (ret < 0) {
+        LOG_WRN("Gesture %d behavior failed: %d", map->gesture, ret);
+    }
+}
+
+static void invoke_work_handler(struct k_work *work) {
+    uint16_t gestures;
+
+    while (k_msgq_get(&gesture_msgq, &gestures, K_NO_WAIT) == 0) {
+        uint16_t released = held_gestures & ~gestures;
+
+        for (int i = 0; i < ARRAY_SIZE(gesture_maps); i++) {
+            const struct gesture_map *map = &gesture_maps[i];
+            uint16_t bit = BIT(map->gesture);
+
+            if (bit & HOLD_GESTURES) {
+                if ((gestures & bit) && !(held_gestures & bit)) {
+                    invoke_gesture(map, true);
+                } else if (released & bit) {
+                    invoke_gesture(map, false);
+                }
+            } else if (gestures & bit) {
+                invoke_gesture(map, true);
+                invoke_gesture(map, false);
+            }
+        }
+
+        held_gestures = gestures & HOLD_GESTURES;
+    }
+}
+
+static void gesture_work_handler(struct trackpad_rdy_work *rdy_work) {
+    uint8_t buf[2];
+
+    // One register read decodes every gesture the chip detected this cycle. Gesture
+    // events open a window of their own, so taps are seen even without motion.
+    int err = trackpad_rdy_read(rdy_work, IQS7211E_MM_GESTURES, buf, sizeof(buf));
+    if (err == -EAGAIN) {
+        return;
+    }
+    trackpad_rdy_work_submit_next(rdy_work);
+    if (err) {
+        LOG_WRN("Failed to read gestures: %d", err);
+        return;
+    }
+
+    // Pass on taps and swipes, and hold gestures only when they change
+    uint16_t gestures = sys_get_le16(buf) & mapped_gestures;
+    if (gestures == read_gestures && !(gestures & ~HOLD_GESTURES)) {
+        return;
+    }
+    read_gestures = gestures;
+
+    if (k_msgq_put(&gesture_msgq, &gestures, K_NO_WAIT)) {
+        LOG_WRN("Gesture queue full");
+    }
+    k_work_submit(&invoke_work);
+}
+
+static int trackpad_gestures_init(void) {
+    k_work_init(&invoke_work, invoke_work_handler);
+    trackpad_rdy_work_init(&gesture_work, gesture_work_handler);
+
+    for (int i = 0; i < ARRAY_SIZE(gesture_maps); i++) {
+        mapped_gestures |= BIT(gesture_maps[i].gesture);
+    }
+
+    trackpad_rdy_work_submit_next(&gesture_work);
+    return 0;
+}
+
+SYS_INIT(trackpad_gestures_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
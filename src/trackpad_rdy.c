@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/slist.h>
+
+#include "trackpad_rdy.h"
+
+LOG_MODULE_REGISTER(trackpad_rdy, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKPAD_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)
+#define RDY_STACK_SIZE 1024
+// Ahead of the system workqueue, so a handler gets in before the driver's read
+#define RDY_PRIORITY K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 2)
+
+static const struct i2c_dt_spec trackpad_i2c = I2C_DT_SPEC_GET(TRACKPAD_NODE);
+static const struct gpio_dt_spec rdy_gpio = GPIO_DT_SPEC_GET(TRACKPAD_NODE, irq_gpios);
+static struct gpio_callback rdy_cb;
+static K_THREAD_STACK_DEFINE(rdy_stack, RDY_STACK_SIZE);
+static struct k_work_q rdy_queue;
+static struct k_spinlock rdy_lock;
+static sys_slist_t waiting_list = SYS_SLIST_STATIC_INIT(&waiting_list);
+static atomic_t bus_bytes;
+
+// RDY is pulled low while the window is open
+static bool window_open(void) { return gpio_pin_get_dt(&rdy_gpio) == 0; }
+
+// Call with rdy_lock held
+static void wait_for_window(struct trackpad_rdy_work *rdy_work) {
+    if (!rdy_work->waiting) {
+        rdy_work->waiting = true;
+        sys_slist_append(&waiting_list, &rdy_work->node);
+    }
+}
+
+static void rdy_work_handler(struct k_work *work) {
+    struct trackpad_rdy_work *rdy_work = CONTAINER_OF(work, struct trackpad_rdy_work, work);
+
+    k_spinlock_key_t key = k_spin_lock(&rdy_lock);
+    if (!rdy_work->forced && !window_open()) {
+        wait_for_window(rdy_work);
+        k_spin_unlock(&rdy_lock, key);
+        return;
+    }
+    k_spin_unlock(&rdy_lock, key);
+
+    rdy_work->handler(rdy_work);
+
+    key = k_spin_lock(&rdy_lock);
+    rdy_work->forced = false;
+    k_spin_unlock(&rdy_lock, key);
+}
+
+static void rdy_callback(const struct device *port, struct gpio_callback *cb, uint32_t pins) {
+    struct trackpad_rdy_work *rdy_work, *next;
+
+    k_spinlock_key_t key = k_spin_lock(&rdy_lock);
+    SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&waiting_list, rdy_work, next, node) {
+        sys_slist_remove(&waiting_list, NULL, &rdy_work->node);
+        rdy_work->waiting = false;
+        k_work_submit_to_queue(&rdy_queue, &rdy_work->work);
+    }
+    k_spin_unlock(&rdy_lock, key);
+}
+
+void trackpad_rdy_work_init(struct trackpad_rdy_work *rdy_work, trackpad_rdy_handler_t handler) {
+    k_work_init(&rdy_work->work, rdy_work_handler);
+    rdy_work->handler = handler;
+    rdy_work->waiting = false;
+    rdy_work->forced = false;
+}
+
+void trackpad_rdy_work_submit(struct trackpad_rdy_work *rdy_work) {
+    k_spinlock_key_t key = k_spin_lock(&rdy_lock);
+    if (window_open()) {
+        k_work_submit_to_queue(&rdy_queue, &rdy_work->work);
+    } else {
+        wait_for_window(rdy_work);
+    }
+    k_spin_unlock(&rdy_lock, key);
+}
+
+void trackpad_rdy_work_submit_next(struct trackpad_rdy_work *rdy_work) {
+    k_spinlock_key_t key = k_spin_lock(&rdy_lock);
+    wait_for_window(rdy_work);
+    k_spin_unlock(&rdy_lock, key);
+}
+
+void trackpad_rdy_work_force(struct trackpad_rdy_work *rdy_work) {
+    k_spinlock_key_t key = k_spin_lock(&rdy_lock);
+    rdy_work->forced = true;
+    k_work_submit_to_queue(&rdy_queue, &rdy_work->work);
+    k_spin_unlock(&rdy_lock, key);
+}
+
+static int check_window(struct trackpad_rdy_work *rdy_work) {
+    if (rdy_work->forced || window_open()) {
+        return 0;
+    }
+
+    trackpad_rdy_work_submit(rdy_work);
+    return -EAGAIN;
+}
+
+int trackpad_rdy_read(struct trackpad_rdy_work *rdy_work, uint8_t reg, uint8_t *buf, size_t len) {
+    int err = check_window(rdy_work);
+    if (err) {
+        return err;
+    }
+
+    atomic_add(&bus_bytes, 1 + len);
+    return i2c_burst_read_dt(&trackpad_i2c, reg, buf, len);
+}
+
+int trackpad_rdy_write(struct trackpad_rdy_work *rdy_work, uint8_t reg, const uint8_t *buf,
+                       size_t len) {
+    int err = check_window(rdy_work);
+    if (err) {
+        return err;
+    }
+
+    atomic_add(&bus_bytes, 1 + len);
+    return i2c_burst_write_dt(&trackpad_i2c, reg, buf, len);
+}
+
+atomic_val_t trackpad_rdy_take_bytes(void) { return atomic_clear(&bus_bytes); }
+
+static int trackpad_rdy_init(void) {
+    k_work_queue_start(&rdy_queue, rdy_stack, K_THREAD_STACK_SIZEOF(rdy_stack), RDY_PRIORITY,
+                       NULL);
+
+    // The driver owns the RDY interrupt configuration, only listen alongside it
+    gpio_init_callback(&rdy_cb, rdy_callback, BIT(rdy_gpio.pin));
+    int err = gpio_add_callback(rdy_gpio.port, &rdy_cb);
+    if (err) {
+        LOG_ERR("Failed to add RDY callback: %d", err);
+        return err;
+    }
+
+    return 0;
+}
+
+SYS_INIT(trackpad_rdy_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+// Register access next to the IQS7211E driver. The chip only answers inside
+// the communication window it opens by pulling RDY low, an access outside it
+// stretches the clock until the next cycle.
+struct trackpad_rdy_work;
+typedef void (*trackpad_rdy_handler_t)(struct trackpad_rdy_work *rdy_work);
+
+struct trackpad_rdy_work {
+    struct k_work work;
+    sys_snode_t node;
+    trackpad_rdy_handler_t handler;
+    bool waiting;
+    bool forced;
+};
+
+void trackpad_rdy_work_init(struct trackpad_rdy_work *rdy_work, trackpad_rdy_handler_t handler);
+
+// Run the handler in the open window, or in the next one the chip opens
+void trackpad_rdy_work_submit(struct trackpad_rdy_work *rdy_work);
+
+// Run the handler in the next window, for handlers that re-arm themselves
+void trackpad_rdy_work_submit_next(struct trackpad_rdy_work *rdy_work);
+
+// Run the handler now, for writes that cannot wait for a window. The access
+// stretches the clock until the chip's next cycle, off the system workqueue.
+void trackpad_rdy_work_force(struct trackpad_rdy_work *rdy_work);
+
+// Accesses from a handler. Outside a forced handler they fail with -EAGAIN once
+// the window has closed, and the handler is run again in the next one.
+int trackpad_rdy_read(struct trackpad_rdy_work *rdy_work, uint8_t reg, uint8_t *buf, size_t len);
+int trackpad_rdy_write(struct trackpad_rdy_work *rdy_work, uint8_t reg, const uint8_t *buf,
+                       size_t len);
+
+// Register address and data bytes sent and received by these accesses since the
+// last call. The driver's own reads are not counted.
+atomic_val_t trackpad_rdy_take_bytes(void);
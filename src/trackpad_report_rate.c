@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/usb.h>
+
+#include "iqs7211e_mm.h"
+#include "mini_trackpad_iqs7211e_init.h"
+#include "trackpad_rdy.h"
+
+LOG_MODULE_REGISTER(trackpad_report_rate, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKPAD_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)
+
+#define IMAGE_REPORT_RATE_MS (ACTIVE_MODE_REPORT_RATE_0 | (ACTIVE_MODE_REPORT_RATE_1 << 8))
+
+#define MIN_REPORT_RATE_MS CONFIG_TORABO_TRACKPAD_MIN_REPORT_RATE_MS
+
+BUILD_ASSERT(MIN_REPORT_RATE_MS <= IMAGE_REPORT_RATE_MS,
+             "Minimum report period must not exceed the register image default");
+
+// The driver re-initialises the chip back to the image rate after a reset, so
+// read the register back on the first report after a pause in addition to
+// link changes
+#define REPORT_GAP_MS 1000
+
+static struct trackpad_rdy_work report_rate_work;
+static uint16_t link_interval_ms = IMAGE_REPORT_RATE_MS;
+static uint32_t last_report_time;
+
+// BLE connection interval is in 1.25ms units
+static uint16_t conn_interval_to_ms(uint16_t interval) { return (interval * 5) / 4; }
+
+static uint16_t target_report_rate(void) {
+    // USB polls every 1ms, so only the scan time limits the rate
+    if (IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) && zmk_usb_is_hid_ready()) {
+        return MIN_REPORT_RATE_MS;
+    }
+
+    return CLAMP(link_interval_ms, MIN_REPORT_RATE_MS, IMAGE_REPORT_RATE_MS);
+}
+
+static void report_rate_update(struct trackpad_rdy_work *rdy_work) {
+    uint16_t rate = target_report_rate();
+    uint8_t buf[2];
+
+    if (trackpad_rdy_read(rdy_work, IQS7211E_MM_ACTIVE_MODE_RR, buf, sizeof(buf))) {
+        return;
+    }
+    if (sys_get_le16(buf) == rate) {
+        return;
+    }
+
+    sys_put_le16(rate, buf);
+    int err = trackpad_rdy_write(rdy_work, IQS7211E_MM_ACTIVE_MODE_RR, buf, sizeof(buf));
+    if (err) {
+        if (err != -EAGAIN) {
+            LOG_WRN("Failed to set trackpad report rate: %d", err);
+        }
+        return;
+    }
+
+    LOG_INF("Trackpad report rate set to %d ms", rate);
+}
+
+static void trackpad_input_callback(struct input_event *evt) {
+    if (!evt->sync) {
+        return;
+    }
+
+    uint32_t now = k_uptime_get_32();
+    if (now - last_report_time > REPORT_GAP_MS) {
+        trackpad_rdy_work_submit(&report_rate_work);
+    }
+    last_report_time = now;
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(TRACKPAD_NODE), trackpad_input_callback);
+
+static bool is_host_conn(struct bt_conn *conn, struct bt_conn_info *info) {
+    if (bt_conn_get_info(conn, info) != 0) {
+        return false;
+    }
+
+    // Host link on the central, split link on the peripheral
+    return (info->role == BT_CONN_ROLE_PERIPHERAL && info->type == BT_CONN_TYPE_LE);
+}
+
+static void report_rate_connected_cb(struct bt_conn *conn, uint8_t err) {
+    struct bt_conn_info info;
+    if (err || !is_host_conn(conn, &info)) {
+        return;
+    }
+
+    link_interval_ms = conn_interval_to_ms(info.le.interval);
+    trackpad_rdy_work_submit(&report_rate_work);
+}
+
+static void report_rate_disconnected_cb(struct bt_conn *conn, uint8_t reason) {
+    struct bt_conn_info info;
+    if (!is_host_conn(conn, &info)) {
+        return;
+    }
+
+    link_interval_ms = IMAGE_REPORT_RATE_MS;
+    trackpad_rdy_work_submit(&report_rate_work);
+}
+
+static void report_rate_param_updated_cb(struct bt_conn *conn, uint16_t interval,
+                                         uint16_t latency, uint16_t timeout) {
+    struct bt_conn_info info;
+    if (!is_host_conn(conn, &info)) {
+        return;
+    }
+
+    link_interval_ms = conn_interval_to_ms(interval);
+    LOG_DBG("Host interval %d ms", link_interval_ms);
+    trackpad_rdy_work_submit(&report_rate_work);
+}
+
+static struct bt_conn_cb report_rate_conn_callbacks = {
+    .connected = report_rate_connected_cb,
+    .disconnected = report_rate_disconnected_cb,
+    .le_param_updated = report_rate_param_updated_cb,
+};
+
+static int usb_conn_state_listener(const zmk_event_t *eh) {
+    trackpad_rdy_work_submit(&report_rate_work);
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(trackpad_report_rate_usb, usb_conn_state_listener);
+ZMK_SUBSCRIPTION(trackpad_report_rate_usb, zmk_usb_conn_state_changed);
+
+static int trackpad_report_rate_init(void) {
+    trackpad_rdy_work_init(&report_rate_work, report_rate_update);
+    bt_conn_cb_register(&report_rate_conn_callbacks);
+    return 0;
+}
+
+SYS_INIT(trackpad_report_rate_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// copyright (C) 2025 sekigon-gonnoc
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+#include "iqs7211e_mm.h"
+#include "mini_trackpad_iqs7211e_init.h"
+#include "trackpad_rdy.h"
+
+LOG_MODULE_REGISTER(trackpad_stats, CONFIG_ZMK_LOG_LEVEL);
+
+#define TRACKPAD_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(azoteq_iqs7211e)
+#define STATS_PERIOD_MS 1000
+
+// RDY is only asserted on touch or gesture changes, not every report period
+BUILD_ASSERT((CONFIG_SETTINGS1 & IQS7211E_CONFIG1_EVENT_MODE) &&
+                 (CONFIG_SETTINGS1 & IQS7211E_CONFIG1_TP_EVENT) &&
+                 (CONFIG_SETTINGS1 & IQS7211E_CONFIG1_GESTURE_EVENT),
+             "Trackpad register image must enable event mode");
+
+static const struct gpio_dt_spec rdy_gpio = GPIO_DT_SPEC_GET(TRACKPAD_NODE, irq_gpios);
+static struct gpio_callback rdy_cb;
+static struct k_work_delayable stats_work;
+static atomic_t rdy_count;
+static atomic_t report_count;
+
+static void stats_log(struct k_work *work) {
+    atomic_val_t rdy = atomic_clear(&rdy_count);
+    atomic_val_t reports = atomic_clear(&report_count);
+    atomic_val_t bytes = trackpad_rdy_take_bytes();
+
+    // Stay quiet and stop polling while the pad is idle
+    if (rdy == 0 && reports == 0) {
+        return;
+    }
+
+    // Only this module's register accesses, the driver's report reads come on top
+    LOG_INF("Trackpad %ld RDY/s, %ld reports/s, %ld I2C B/s", rdy * 1000 / STATS_PERIOD_MS,
+            reports * 1000 / STATS_PERIOD_MS, bytes * 1000 / STATS_PERIOD_MS);
+    k_work_schedule(&stats_work, K_MSEC(STATS_PERIOD_MS));
+}
+
+static void rdy_callback(const struct device *port, struct gpio_callback *cb, uint32_t pins) {
+    atomic_inc(&rdy_count);
+    if (!k_work_delayable_is_pending(&stats_work)) {
+        k_work_schedule(&stats_work, K_MSEC(STATS_PERIOD_MS));
+    }
+}
+
+static void trackpad_input_callback(struct input_event *evt) {
+    if (evt->sync) {
+        atomic_inc(&report_count);
+    }
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(TRACKPAD_NODE), trackpad_input_callback);
+
+static int trackpad_stats_init(void) {
+    k_work_init_delayable(&stats_work, stats_log);
+
+    // The driver owns the RDY interrupt configuration, only listen alongside it
+    gpio_init_callback(&rdy_cb, rdy_callback, BIT(rdy_gpio.pin));
+    int err = gpio_add_callback(rdy_gpio.port, &rdy_cb);
+    if (err) {
+        LOG_ERR("Failed to add RDY callback: %d", err);
+        return err;
+    }
+
+    return 0;
+}
+
+SYS_INIT(trackpad_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);